@@ -0,0 +1,354 @@
+/****************************************************************************************************
+  @file armFleet.cpp
+  @brief Scheduler class to run several robot arms and a shared set of joysticks from one controller
+  @author Jeremy Reynolds <62484970+jeremy-reynolds@users.noreply.github.com>
+  @version 1.0.0
+  @date 2026/10/18
+
+  @details
+  armFleet time-multiplexes up to FLEET_MAX_ARMS robotArm objects, each on its own PCA9685 board. One arm
+  at a time has the focus and is driven by the two joysticks.  The other arms play back their stored
+  programs. The select button moves the focus to the next arm and the record button stores the current
+  pose of the focused arm as a program step, or clears its program while the motors are disabled.
+
+  version 1.0.0 - initial version
+
+  # LICENSE #
+
+  MIT License
+
+  Copyright (c) 2024 dolphin-tiger
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+
+****************************************************************************************************/
+#include "armFleet.h"
+#include <Arduino.h>
+
+  armFleet::armFleet(joystick &j1, joystick &j2) {
+    joy1 = &j1;
+    joy2 = &j2;
+  }
+
+  bool armFleet::addArm(robotArm &a) {
+    if(armCount >= FLEET_MAX_ARMS) return false;
+
+    arm[armCount] = &a;
+    armCount++;
+    return true;
+  }
+
+  void armFleet::setButtons(int select, int record) {
+    selectPin = select;
+    recordPin = record;
+
+    pinMode(selectPin, INPUT_PULLUP);
+    pinMode(recordPin, INPUT_PULLUP);
+
+    selectState = digitalRead(selectPin);
+    recordState = digitalRead(recordPin);
+  }
+
+  void armFleet::attach() {
+    for(uint8_t i = 0; i < armCount; i++) {
+      Serial.print("Attaching arm "); Serial.print(i); Serial.print(" at 0x"); Serial.println(arm[i]->getAddress(), HEX);
+      arm[i]->attach();
+    }
+
+    //--- start the timers from here so the time spent in setup does not count as a late tick
+    tickTime    = millis();
+    statTime    = millis();
+    btnReadTime = millis();
+    resetStats();
+  }
+
+  //-- run methods ----------------------------------------------------------------------------
+  bool armFleet::run() {
+    if(armCount == 0) return false;
+
+    //--- using millis() to service the arms every 1/20th of a second and avoid blocking in the code
+    runTick();
+
+    if( debug == true && millis() - statTime >= statDelay ) {
+      statTime = millis();
+      printStats();
+
+      //--- start a new window so each line only covers the last statDelay
+      resetStats();
+    }
+
+    if( millis() - btnReadTime >= btnReadDelay ) {
+      btnReadTime = millis();
+      readButtons();
+      return true;
+    }
+
+    return false;
+  }
+
+  bool armFleet::runTick() {
+    unsigned long now = millis();
+    if( now - tickTime < tickDelay ) return false;
+
+    //--- how late the tick starts, anything that blocked the loop (like a full serial buffer) shows up here
+    unsigned long late = now - tickTime - tickDelay;
+    statLateTotal += late;
+    if(late > statLateMax) statLateMax = late;
+
+    tickTime = now;
+    tick();
+    return true;
+  }
+
+  void armFleet::tick() {
+    unsigned long start = micros();
+
+    //--- the focused arm always gets the joysticks first
+    int16_t x1 = 0; int16_t y1 = 0;
+    int16_t x2 = 0; int16_t y2 = 0;
+    if(arm[focus]->getDisable() == false) {
+      x1 = joy1->getPosition(X, -10, 10, true);
+      y1 = joy1->getPosition(Y, -10, 10);
+
+      x2 = joy2->getPosition(X, -10, 10, true);
+      y2 = joy2->getPosition(Y, -10, 10);
+
+      arm[focus]->drive(x1, y1, x2, y2);
+    }
+
+    //--- the other arms share what is left of the budget round robin, starting where the last tick stopped
+    uint8_t serviced = 0;
+    for(uint8_t n = 0; n < armCount; n++) {
+      if(serviced > 0 && micros() - start >= tickBudget) break;
+
+      uint8_t i = cursor;
+      cursor = (cursor + 1) % armCount;
+      if(i == focus) continue;
+
+      arm[i]->play();
+      serviced++;
+    }
+
+    //--- capture the latency of the tick
+    statLast = micros() - start;
+    statTotal += statLast;
+    statTicks++;
+    if(statLast > statMax) statMax = statLast;
+    if(serviced < statServicedMin) statServicedMin = serviced;
+
+    //--- print the output if it is not at the neutral position
+    //--- this is done after the latency is captured so a full serial buffer does not count against the tick
+    //--- and skipped while benchmarking because at 9600 baud it would make the next tick late
+      if(benchmarking == true) return;
+      if(x1 != 0 || y1 != 0) { Serial.print("Joy1 x1:"); Serial.print(x1); Serial.print(", y1:"); Serial.print(y1); Serial.print(", time:"); Serial.println(millis());}
+      if(x2 != 0 || y2 != 0) { Serial.print("Joy2 x2:"); Serial.print(x2); Serial.print(", y2:"); Serial.print(y2); Serial.print(", time:"); Serial.println(millis());}
+  }
+
+  void armFleet::readButtons() {
+    //--- check for button presses
+      bool b1 = joy1->getButton();
+      bool b2 = joy2->getButton();
+      bool bs = readButton(selectPin, selectState);
+      bool br = readButton(recordPin, recordState);
+
+    //--- enable or disable motors of the focused arm
+      if(b1 == true) {
+        arm[focus]->toggleDisable();
+      }
+
+    //--- enable or disable levelMode of the focused arm
+      if(b2 == true) {
+        arm[focus]->toggleLevelMode();
+      }
+
+    //--- move the focus to the next arm
+      if(bs == true) {
+        nextFocus();
+      }
+
+    //--- store the current pose of the focused arm in its program, or clear the program while the motors are disabled
+      if(br == true) {
+        if(arm[focus]->getDisable() == true) {
+          arm[focus]->clearProgram();
+        }
+        else if(arm[focus]->addProgramStep() == false) {
+          Serial.println("Program full!");
+        }
+      }
+
+      if(b1) Serial.println("Button 1 Pressed!");
+      if(b2) Serial.println("Button 2 Pressed!");
+      if(bs) { Serial.print("Focus arm "); Serial.println(focus); }
+      if(br) { Serial.print("Program steps:"); Serial.println(arm[focus]->getProgramLength()); }
+  }
+
+  /**
+    @brief method to report the state of a button release
+    @details
+    Works the same as joystick::getButton().  Returns true when the button is
+    released and false when the pin has not been set.
+  */
+  bool armFleet::readButton(int pin, bool &state) {
+    if(pin < 0) return false;
+
+    bool val = digitalRead(pin);
+    if(state != val) {
+      state = val;
+      return state;
+    }
+    return false;
+  }
+
+  //-- focus methods --------------------------------------------------------------------------
+  void armFleet::setFocus(uint8_t index) {
+    if(index < armCount) focus = index;
+  }
+
+  void armFleet::nextFocus() {
+    if(armCount > 0) focus = (focus + 1) % armCount;
+  }
+
+  uint8_t armFleet::getFocus() {
+    return focus;
+  }
+
+  robotArm &armFleet::getFocusArm() {
+    return *arm[focus];
+  }
+
+  uint8_t armFleet::getArmCount() {
+    return armCount;
+  }
+
+  //-- timing methods -------------------------------------------------------------------------
+  void armFleet::setTickDelay(unsigned long ms) {
+    tickDelay = ms;
+  }
+
+  void armFleet::setTickBudget(unsigned long us) {
+    tickBudget = us;
+  }
+
+  //-- latency stats methods ------------------------------------------------------------------
+  unsigned long armFleet::getTickMicros() {
+    return statLast;
+  }
+
+  unsigned long armFleet::getAvgTickMicros() {
+    if(statTicks == 0) return 0;
+    return statTotal / statTicks;
+  }
+
+  unsigned long armFleet::getMaxTickMicros() {
+    return statMax;
+  }
+
+  unsigned long armFleet::getAvgLateMillis() {
+    if(statTicks == 0) return 0;
+    return statLateTotal / statTicks;
+  }
+
+  unsigned long armFleet::getMaxLateMillis() {
+    return statLateMax;
+  }
+
+  uint8_t armFleet::getMinServiced() {
+    if(statTicks == 0) return 0;
+    return statServicedMin;
+  }
+
+  void armFleet::resetStats() {
+    statTicks = 0;
+    statTotal = 0;
+    statMax   = 0;
+    statLast  = 0;
+    statServicedMin = FLEET_MAX_ARMS;
+    statLateTotal = 0;
+    statLateMax   = 0;
+  }
+
+  void armFleet::printStats() {
+    Serial.print("fleet arms:"); Serial.print(armCount);
+    Serial.print(", tick us last:"); Serial.print(statLast);
+    Serial.print(", avg:"); Serial.print(getAvgTickMicros());
+    Serial.print(", max:"); Serial.print(statMax);
+    Serial.print(", min serviced:"); Serial.print(getMinServiced());
+    Serial.print(", late ms avg:"); Serial.print(getAvgLateMillis());
+    Serial.print(", max:"); Serial.println(statLateMax);
+  }
+
+  //-- benchmark methods ----------------------------------------------------------------------
+  void armFleet::benchmark(uint16_t ticks) {
+    if(armCount == 0) return;
+    uint8_t fleetCount = armCount;
+
+    //--- give every arm a program that sweeps the base motor so playback writes to the board every tick
+    for(uint8_t i = 0; i < fleetCount; i++) {
+      int x1 = arm[i]->getCenterPosition(X1);
+      int y1 = arm[i]->getCenterPosition(Y1);
+      int y2 = arm[i]->getCenterPosition(Y2);
+
+      arm[i]->clearProgram();
+      arm[i]->addProgramStep(x1 - 20, y1, y2);
+      arm[i]->addProgramStep(x1 + 20, y1, y2);
+      arm[i]->setDisable(false);
+    }
+
+    benchmarking = true;
+    Serial.print("\nfleet benchmark, ticks per row:"); Serial.print(ticks);
+    Serial.print(", tick ms:"); Serial.print(tickDelay);
+    Serial.print(", budget us:"); Serial.println(tickBudget);
+    Serial.println("| Arms | Avg tick us | Max tick us | Min serviced | Avg late ms | Max late ms |");
+    Serial.println("|----|----|----|----|----|----|");
+
+    //--- run the fleet with 1 arm up to every arm, the focus stays on arm 0
+    for(uint8_t count = 1; count <= fleetCount; count++) {
+      armCount = count;
+      focus    = 0;
+      cursor   = 0;
+
+      tickTime = millis();
+      resetStats();
+      while(statTicks < ticks) {
+        runTick();
+      }
+
+      //--- the row is printed between runs so it does not count against any tick
+      Serial.print("| ");   Serial.print(count);
+      Serial.print(" | ");  Serial.print(getAvgTickMicros());
+      Serial.print(" | ");  Serial.print(statMax);
+      Serial.print(" | ");  Serial.print(getMinServiced());
+      Serial.print(" | ");  Serial.print(getAvgLateMillis());
+      Serial.print(" | ");  Serial.print(statLateMax);
+      Serial.println(" |");
+    }
+
+    //--- put the fleet back the way it was
+    armCount = fleetCount;
+    for(uint8_t i = 0; i < fleetCount; i++) {
+      arm[i]->setDisable(true);
+      arm[i]->clearProgram();
+    }
+    benchmarking = false;
+
+    tickTime    = millis();
+    statTime    = millis();
+    btnReadTime = millis();
+    resetStats();
+  }
@@ -0,0 +1,220 @@
+/****************************************************************************************************
+  @file armFleet.h
+  @brief Scheduler class to run several robot arms and a shared set of joysticks from one controller
+  @author Jeremy Reynolds <62484970+jeremy-reynolds@users.noreply.github.com>
+  @version 1.0.0
+  @date 2026/10/18
+
+  @details
+  armFleet time-multiplexes up to FLEET_MAX_ARMS robotArm objects, each on its own PCA9685 board. One arm
+  at a time has the focus and is driven by the two joysticks.  The other arms play back their stored
+  programs. The select button moves the focus to the next arm and the record button stores the current
+  pose of the focused arm as a program step, or clears its program while the motors are disabled.
+
+  Every tick the focused arm is serviced first.  The remaining arms are then serviced round robin until
+  the tick budget (microseconds) is used up, and the next tick carries on where the last one stopped so
+  every background arm gets the same share of time.  At least one background arm is serviced per tick.
+  The time each tick takes is captured so the latency can be watched as arms are added.
+
+  version 1.0.0 - initial version
+
+  # LICENSE #
+
+  MIT License
+
+  Copyright (c) 2024 dolphin-tiger
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+
+****************************************************************************************************/
+
+#ifndef armFleet_h
+#define armFleet_h
+
+  #include <Arduino.h>
+  #include "joystick.h"
+  #include "robotArm.h"
+
+  #define FLEET_MAX_ARMS 8
+
+  class armFleet {
+    private:
+
+      /**
+        @brief the input devices and arms run by the fleet
+
+        @details
+        The joysticks are shared by all arms and only ever drive the arm that
+        has the focus.  focus is the index of that arm and cursor is the index
+        of the next background arm to service.
+      */
+      joystick *joy1;
+      joystick *joy2;
+      robotArm *arm[FLEET_MAX_ARMS] = {};
+      uint8_t armCount = 0;
+      uint8_t focus    = 0;
+      uint8_t cursor   = 0;
+
+      /**
+        @brief pins and states of the select and record buttons
+
+        @details
+        The pins are left at -1 until setButtons() is called so the fleet can
+        also run with the joystick buttons only.
+      */
+      int selectPin = -1;
+      int recordPin = -1;
+      bool selectState = true;
+      bool recordState = true;
+      bool benchmarking = false;
+      bool readButton(int pin, bool &state);
+
+      /**
+        @brief variables for timer to use millis for non-blocking code
+
+        @details
+        tickDelay is the time between ticks in milliseconds and tickBudget is
+        how long a tick may spend servicing arms in microseconds.
+      */
+      unsigned long tickTime     = 0;
+      unsigned long tickDelay    = 50;
+      unsigned long tickBudget   = 20000;
+      unsigned long btnReadTime  = 0;
+      unsigned long btnReadDelay = 50;
+
+      /**
+        @brief variables to capture the per tick latency
+
+        @details
+        Latency is measured with micros() from the start of the tick until the
+        last arm has been serviced.  The joystick prints happen after the
+        measurement so they are not counted.  statServicedMin is the fewest
+        background arms serviced by any tick, so a full budget shows up even if
+        the last tick was a quiet one.  statLate is how many milliseconds
+        after tickDelay a tick actually started, which catches anything that
+        blocks the loop between ticks (serial prints, i2c).  When debug is on the stats are printed
+        and reset once every statDelay milliseconds, so each printed line only
+        covers that window.
+      */
+      unsigned long statTicks    = 0;
+      unsigned long statTotal    = 0;
+      unsigned long statMax      = 0;
+      unsigned long statLast     = 0;
+      uint8_t statServicedMin    = FLEET_MAX_ARMS;
+      unsigned long statLateTotal = 0;
+      unsigned long statLateMax   = 0;
+      unsigned long statTime     = 0;
+      unsigned long statDelay    = 1000;
+
+      bool runTick();
+      void tick();
+      void readButtons();
+
+    public:
+      bool debug = false;
+
+      /**
+      @brief Class constructor. Create a new fleet driven by two joysticks
+      @param j1 (joystick 1, moves X1 and Y1 and toggles the motors on/off)
+      @param j2 (joystick 2, moves Y2 and toggles level mode)
+      */
+      armFleet(joystick &j1, joystick &j2);
+
+      /**
+      @brief method to add an arm to the fleet
+      @details
+      Returns false when the fleet already holds FLEET_MAX_ARMS arms.  At least
+      one arm must be added before calling attach() or getFocusArm().
+      */
+      bool addArm(robotArm &a);
+
+      /**
+      @brief method to set the select and record button pins
+      @param select (pin of the button that moves the focus to the next arm)
+      @param record (pin of the button that stores a program step on the focused arm, or clears
+                     the program when the focused arm is disabled)
+      */
+      void setButtons(int select, int record);
+
+      /**
+      @brief method to attach every arm in the fleet
+      */
+      void attach();
+
+      /**
+      @brief method to run the fleet, call this every loop
+      @details
+      This is non-blocking and returns true when the buttons were read so the
+      caller can refresh anything that shows the mode of the focused arm.
+      */
+      bool run();
+
+      /**
+      @brief methods to set or get the arm with the focus
+      @details
+      getFocusArm() returns a reference to the focused arm so the fleet must
+      hold at least one arm, check getArmCount() first if that is not certain.
+      */
+      void setFocus(uint8_t index);
+      void nextFocus();
+      uint8_t getFocus();
+      robotArm &getFocusArm();
+      uint8_t getArmCount();
+
+      /**
+      @brief methods to set the tick timing
+      @param ms (time between ticks in milliseconds)
+      @param us (time a tick may spend servicing arms in microseconds)
+      */
+      void setTickDelay(unsigned long ms);
+      void setTickBudget(unsigned long us);
+
+      /**
+      @brief methods to get and reset the per tick latency stats
+      @details
+      Tick times are in microseconds and late times in milliseconds.
+      getMaxTickMicros() reports the slowest tick, getMaxLateMillis() the
+      latest tick start and getMinServiced() the fewest background arms
+      serviced by a tick since the last resetStats().
+      */
+      unsigned long getTickMicros();
+      unsigned long getAvgTickMicros();
+      unsigned long getMaxTickMicros();
+      unsigned long getAvgLateMillis();
+      unsigned long getMaxLateMillis();
+      uint8_t getMinServiced();
+      void resetStats();
+      void printStats();
+
+      /**
+      @brief method to measure how the tick latency scales with the number of arms
+      @details
+      Runs the fleet with 1 arm, then 2, and so on up to every arm added, for
+      the given number of ticks each and prints one table row per arm count.
+      Every arm is enabled and given a program that sweeps the base motor 20
+      degrees either side of center, so the arms WILL move.  Arm 0 has the
+      focus the whole time so it plays no program, just like a normal run.
+      This blocks until it is done, then disables the arms and clears their
+      programs.  Joystick prints are skipped while it runs.
+      @param ticks (number of ticks to run for each arm count)
+      */
+      void benchmark(uint16_t ticks);
+  };
+
+#endif
@@ -2,8 +2,8 @@
   @file robot-arm.ino
   @brief main code for controlling the servo based robot arm
   @author Jeremy Reynolds <62484970+jeremy-reynolds@users.noreply.github.com>
-  @version 1.0.7
-  @date 2024/04/14
+  @version 1.1.0
+  @date 2026/10/18
 
   @details
   robot-arm is a 5th grade GT class project to build and control a robotic arm utilizing an Arduino controller, 
@@ -13,6 +13,10 @@
   recreate all the code from scratch. This project has a good mixture of scratch code along with libraries like 
   from Adafruit and other even more obvious like <Arduino.h>.
 
+  version 1.1.0 - moved the arm state and mode logic into robotArm and run the arms with armFleet so one
+                  controller can drive several arms, each on its own PCA9685 board. fleet.benchmark() prints
+                  how the tick latency scales with the number of arms.
+
   # LICENSE #
   
   MIT License
@@ -41,7 +45,8 @@
 
 #include <Arduino.h>
 #include "joystick.h"
-#include "robotMotor.h"
+#include "robotArm.h"
+#include "armFleet.h"
 #include <Adafruit_NeoPixel.h>
 
 /*----------------------------------------------------------------------------------------------------
@@ -51,30 +56,24 @@ joystick joy1(A0, A1, 2);
 joystick joy2(A2, A3, 3);
 
 /*----------------------------------------------------------------------------------------------------
---- define the motor objects
-------------------------------------------------------------------------------------------------------*/
-typedef enum motorAxis:uint8_t {X1=0, Y1, Y2} motorAxis_t;  //-- enum to use for motor labels
-robotMotor motor[3];
-int pwm_i2c = 0x40;
-
-/*----------------------------------------------------------------------------------------------------
---- variables for timer to use millis for non-blocking code
+--- define the arm objects
+----- Each arm has its own PCA9685 board (i2c address) and motor disable pin.  Add a line here for
+----- every arm in the cell, up to FLEET_MAX_ARMS.  The VE2 has one board so only the first arm is used.
 ------------------------------------------------------------------------------------------------------*/
-long joyReadTime = 0;
-long joyReadDelay = 50;
-long btnReadTime = 0;
-long btnReadDelay = 50;
+robotArm arm[] = {
+  robotArm(0x40, 24),
+  //robotArm(0x41, 25),
+};
 
 /*----------------------------------------------------------------------------------------------------
---- variables for what mode the motors are in.
------ Level Mode
----   - true: second Y motor will move to 90deg from first Y motor
----   - false: second Y motor will be controlled by Joystick 2
+--- define the fleet that runs the arms
+----- select button: move the joysticks to the next arm
+----- record button: store the current pose of the focused arm in its program, or clear the program
+-----                while the focused arm is disabled
 ------------------------------------------------------------------------------------------------------*/
-bool motorDisable    = true;
-int motorDisablePin  = 24;
-bool levelMode       = false;
-int levelMode_offset = 55;
+armFleet fleet(joy1, joy2);
+int selectPin = 4;
+int recordPin = 5;
 
 /*----------------------------------------------------------------------------------------------------
 --- neopixel objects
@@ -95,39 +94,22 @@ void setup() {
       joy1.calibrateCenter();
       joy2.calibrateCenter();
 
-  //-- setup servos after calibration ----------------------------------------------------------------
+  //-- setup arms after calibration ------------------------------------------------------------------
     Serial.println("Attaching Servos...");
-
-    //-- setup x-motor -------------------------------
-      motor[X1].setMinPosition(0);
-      motor[X1].setMaxPosition(180);
-      motor[X1].setCenterPosition(90);
-      motor[X1].attach(0x40, X1);
-
-    //-- setup y1-motor -------------------------------
-      motor[Y1].setMinPosition(90);
-      motor[Y1].setMaxPosition(170);
-      motor[Y1].setCenterPosition(110);
-      motor[Y1].attach(0x40, Y1);
-
-    //-- setup y2-motor -------------------------------
-      motor[Y2].setMinPosition(0);
-      motor[Y2].setMaxPosition(180);
-      motor[Y2].setCenterPosition(85);
-      motor[Y2].attach(0x40, Y2);
-      motor[Y2].setPosition( map( motor[Y1].getPosition(), 0, 180, 180, 0) + levelMode_offset );
+      //fleet.debug = true;
+      //arm[0].setMotorLimits(Y1, 90, 170, 110);   //-- change the servo travel of an arm here if it is not a VE2
+      for(uint8_t i = 0; i < sizeof(arm) / sizeof(arm[0]); i++) {
+        fleet.addArm(arm[i]);
+      }
+      fleet.setButtons(selectPin, recordPin);
+      fleet.attach();
+      //fleet.benchmark(200);   //-- sweep 1 to every arm and print a tick latency table, the arms will move
 
     //-- setup other things in the code -----------------
       pinMode(LED_BUILTIN, OUTPUT);
-      digitalWrite(LED_BUILTIN,levelMode);
+      digitalWrite(LED_BUILTIN, fleet.getFocusArm().getLevelMode());
       neo.begin();
 
-      delay (10);
-      pinMode(motorDisablePin, OUTPUT);
-
-      delay (10);
-      digitalWrite(motorDisablePin, motorDisable);
-
       delay (10);
       ledColor();
 }
@@ -136,93 +118,27 @@ void setup() {
 --- main code to run in a loop 
 ------------------------------------------------------------------------------------------------------*/
 void loop() {
-  //--- using millis() to read joystick every 1/20th of a second and avoid blocking in the code
-  if( millis() - joyReadTime >= joyReadDelay && motorDisable == false) {
-    joyReadTime = millis();
-
-    //--- read the joystick and scale the output to the specified range (range is optional)
-      int16_t x1 = joy1.getPosition(X, -10, 10, true);
-      int16_t y1 = joy1.getPosition(Y, -10, 10);
-
-      int16_t x2 = joy2.getPosition(X, -10, 10, true);
-      int16_t y2 = joy2.getPosition(Y, -10, 10);
-
-    //-- motor[Xn] movements
-      if(x1 != 0) {
-        motor[X1].moveInc(x1);
-      }
-      if(x2 != 0 && levelMode == true) {
-        motor[X1].moveInc(x2);
-      }
-      
-    //-- motor[Yn] movements and levelMode
-      if(levelMode == true){
-        if(y1 != 0) {
-          motor[Y1].moveInc(y1);
-          motor[Y2].setPosition( map( motor[Y1].getPosition(), 0, 180, 180, 0) + levelMode_offset );
-        }
-        if(y2 != 0) {
-          motor[Y1].moveInc(y2);
-          motor[Y2].setPosition( map( motor[Y1].getPosition(), 0, 180, 180, 0) + levelMode_offset );
-        }
-      }
-      else {
-        if (y1 != 0) motor[Y1].moveInc(y1);
-        if (y2 != 0) motor[Y2].moveInc(y2);
-      }
-    
-
-    //--- print the output if it is not at the neutral position
-    
-      if(x1 != 0 || y1 != 0) { Serial.print("Joy1 x1:"); Serial.print(x1); Serial.print(", y1:"); Serial.print(y1); Serial.print(", time:"); Serial.println(millis());}
-      if(x2 != 0 || y2 != 0) { Serial.print("Joy2 x2:"); Serial.print(x2); Serial.print(", y2:"); Serial.print(y2); Serial.print(", time:"); Serial.println(millis());}
-    
-  }
-
-  if( millis() - btnReadTime >= btnReadDelay ) {
-    btnReadTime = millis();
-    //--- check for button presses
-      int16_t b1 = joy1.getButton();
-      int16_t b2 = joy2.getButton();
-
-    //--- enable or disable motors
-      if(b1 == true) {
-        motorDisable = !motorDisable;
-        digitalWrite(motorDisablePin, motorDisable);
-      }
-
-    //--- enable or disable levelMode
-      if(b2 == true && motorDisable == false) {
-
-        //-- change levelMode to opposite value
-        levelMode = !levelMode;
-
-        //-- set position of motor[Y2] to 90deg from motor[Y1]
-        motor[Y2].setPosition( map( motor[Y1].getPosition(), 0, 180, 180, 0) + levelMode_offset );
-
-        //-- use the built-in LED on the board to display the levelMode state
-        digitalWrite(LED_BUILTIN, levelMode);
-      }
-
-      ledColor();
-
-      if(b1) Serial.println("Button 1 Pressed!");
-      if(b2) Serial.println("Button 2 Pressed!");
+  //--- the fleet is non-blocking and returns true after it has read the buttons
+  if( fleet.run() ) {
+    //-- use the built-in LED on the board to display the levelMode state of the focused arm
+    digitalWrite(LED_BUILTIN, fleet.getFocusArm().getLevelMode());
+    ledColor();
   }
-
 }
 
 /*----------------------------------------------------------------------------------------------------
---- function to determine and se the color of the LED's
+--- function to determine and se the color of the LED's from the focused arm
 ------------------------------------------------------------------------------------------------------*/
 void ledColor(){
-  if(motorDisable == true) {
+  robotArm &focusArm = fleet.getFocusArm();
+
+  if(focusArm.getDisable() == true) {
     neo.fill(motorDisable_color); 
   }
-  else if (levelMode == true) {
+  else if (focusArm.getLevelMode() == true) {
     neo.fill(levelMode_color); 
   }
-  else if (levelMode == false) {
+  else if (focusArm.getLevelMode() == false) {
     neo.fill(normalMode_color); 
   }
   neo.show();
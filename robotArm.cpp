@@ -0,0 +1,204 @@
+/****************************************************************************************************
+  @file robotArm.cpp
+  @brief Robot arm class bundling the motors, mode state and stored program of one arm
+  @author Jeremy Reynolds <62484970+jeremy-reynolds@users.noreply.github.com>
+  @version 1.0.0
+  @date 2026/10/18
+
+  @details
+  robotArm packages everything that belongs to a single VE2 arm: the three robotMotor objects on one
+  PCA9685 board, the motor disable pin, the level mode state and a small stored program of poses. Each
+  arm can either be driven by the joysticks (drive) or play back its stored program (play). The armFleet
+  class uses this to run several arms from one controller.
+
+  version 1.0.0 - initial version
+
+  # LICENSE #
+
+  MIT License
+
+  Copyright (c) 2024 dolphin-tiger
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+
+****************************************************************************************************/
+#include "robotArm.h"
+#include <Arduino.h>
+
+  robotArm::robotArm(int i2c, int disablePin) {
+    i2cAddress = i2c;
+    motorDisablePin = disablePin;
+  }
+
+  void robotArm::setMotorLimits(motorAxis_t axis, int min, int max, int center) {
+    if(axis >= ARM_MOTORS || min > max) return;
+
+    minPosition[axis]    = min;
+    maxPosition[axis]    = max;
+    centerPosition[axis] = constrain(center, min, max);
+  }
+
+  int robotArm::getCenterPosition(motorAxis_t axis) {
+    return centerPosition[axis];
+  }
+
+  void robotArm::attach() {
+    //-- setup the motors with the limits of this arm --
+      for(uint8_t i = 0; i < ARM_MOTORS; i++) {
+        motor[i].setMinPosition(minPosition[i]);
+        motor[i].setMaxPosition(maxPosition[i]);
+        motor[i].setCenterPosition(centerPosition[i]);
+        motor[i].attach(i2cAddress, i);
+      }
+      setLevel();
+
+    //-- start with the motors disabled ---------------
+      pinMode(motorDisablePin, OUTPUT);
+      setDisable(true);
+  }
+
+  //-- move methods ---------------------------------------------------------------------------
+  void robotArm::setLevel() {
+    //--- set position of motor[Y2] to 90deg from motor[Y1]
+    motor[Y2].setPosition( map( motor[Y1].getPosition(), 0, 180, 180, 0) + levelMode_offset );
+  }
+
+  void robotArm::drive(int16_t x1, int16_t y1, int16_t x2, int16_t y2) {
+    if(motorDisable == true) return;
+
+    //-- motor[Xn] movements
+      if(x1 != 0) {
+        motor[X1].moveInc(x1);
+      }
+      if(x2 != 0 && levelMode == true) {
+        motor[X1].moveInc(x2);
+      }
+
+    //-- motor[Yn] movements and levelMode
+      if(levelMode == true){
+        if(y1 != 0) {
+          motor[Y1].moveInc(y1);
+          setLevel();
+        }
+        if(y2 != 0) {
+          motor[Y1].moveInc(y2);
+          setLevel();
+        }
+      }
+      else {
+        if (y1 != 0) motor[Y1].moveInc(y1);
+        if (y2 != 0) motor[Y2].moveInc(y2);
+      }
+  }
+
+  bool robotArm::play() {
+    if(motorDisable == true || programLength == 0) return false;
+
+    bool moving = false;
+    for(uint8_t i = 0; i < ARM_MOTORS; i++) {
+      //--- constrain is a macro so work out the distance first
+      int delta = program[programStep][i] - motor[i].getPosition();
+      int step  = constrain( delta, -playbackSpeed, playbackSpeed );
+      if(step != 0) {
+        motor[i].moveInc(step);
+        moving = true;
+      }
+    }
+
+    //--- all motors arrived so go to the next pose, looping back to the start
+    if(moving == false) {
+      programStep = (programStep + 1) % programLength;
+    }
+
+    return true;
+  }
+
+  //-- mode methods ---------------------------------------------------------------------------
+  void robotArm::setDisable(bool disable) {
+    motorDisable = disable;
+    digitalWrite(motorDisablePin, motorDisable);
+  }
+
+  void robotArm::toggleDisable() {
+    setDisable(!motorDisable);
+  }
+
+  bool robotArm::getDisable() {
+    return motorDisable;
+  }
+
+  void robotArm::toggleLevelMode() {
+    if(motorDisable == true) return;
+
+    levelMode = !levelMode;
+    setLevel();
+  }
+
+  bool robotArm::getLevelMode() {
+    return levelMode;
+  }
+
+  //-- program methods ------------------------------------------------------------------------
+  bool robotArm::addProgramStep() {
+    if(programLength >= ARM_PROGRAM_STEPS) return false;
+
+    for(uint8_t i = 0; i < ARM_MOTORS; i++) {
+      program[programLength][i] = motor[i].getPosition();
+    }
+    programLength++;
+    return true;
+  }
+
+  bool robotArm::addProgramStep(int x1, int y1, int y2) {
+    if(programLength >= ARM_PROGRAM_STEPS) return false;
+
+    int pose[ARM_MOTORS] = {x1, y1, y2};
+    for(uint8_t i = 0; i < ARM_MOTORS; i++) {
+      program[programLength][i] = constrain(pose[i], minPosition[i], maxPosition[i]);
+    }
+    programLength++;
+    return true;
+  }
+
+  void robotArm::clearProgram() {
+    programLength = 0;
+    programStep = 0;
+  }
+
+  uint8_t robotArm::getProgramLength() {
+    return programLength;
+  }
+
+  void robotArm::setPlaybackSpeed(uint8_t speed) {
+    if(speed > 0) playbackSpeed = speed;
+  }
+
+  //-- other methods --------------------------------------------------------------------------
+  int robotArm::getAddress() {
+    return i2cAddress;
+  }
+
+  void robotArm::printPosition() {
+    Serial.print("arm[0x");
+    Serial.print(i2cAddress, HEX);
+    Serial.println("]");
+    for(uint8_t i = 0; i < ARM_MOTORS; i++) {
+      motor[i].printPosition();
+    }
+  }
@@ -0,0 +1,194 @@
+/****************************************************************************************************
+  @file robotArm.h
+  @brief Robot arm class bundling the motors, mode state and stored program of one arm
+  @author Jeremy Reynolds <62484970+jeremy-reynolds@users.noreply.github.com>
+  @version 1.0.0
+  @date 2026/10/18
+
+  @details
+  robotArm packages everything that belongs to a single VE2 arm: the three robotMotor objects on one
+  PCA9685 board, the motor disable pin, the level mode state and a small stored program of poses. Each
+  arm can either be driven by the joysticks (drive) or play back its stored program (play). The armFleet
+  class uses this to run several arms from one controller.
+
+  version 1.0.0 - initial version
+
+  # LICENSE #
+
+  MIT License
+
+  Copyright (c) 2024 dolphin-tiger
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+
+****************************************************************************************************/
+
+#ifndef robotArm_h
+#define robotArm_h
+
+  #include <Arduino.h>
+  #include "robotMotor.h"
+
+  #define ARM_MOTORS          3
+  #define ARM_PROGRAM_STEPS   16
+
+  typedef enum motorAxis:uint8_t {X1=0, Y1, Y2} motorAxis_t;  //-- enum to use for motor labels
+
+  class robotArm {
+    private:
+
+      /**
+        @brief parameters for the controller board and motor disable pin of the arm
+
+        @details
+        Every arm has its own PCA9685 board and its own disable pin wired to the
+        OE pin of that board.  Boards are told apart by their i2c address which
+        is set with the address jumpers on the board (0x40, 0x41, ...).
+      */
+      int i2cAddress;
+      int motorDisablePin;
+      robotMotor motor[ARM_MOTORS];
+
+      /**
+        @brief min/max/center position of each motor used by attach()
+
+        @details
+        These default to the VE2 servo travel.  An arm with different travel
+        can change them with setMotorLimits() before attach() is called.
+      */
+      int minPosition[ARM_MOTORS]    = {  0,  90,   0};
+      int maxPosition[ARM_MOTORS]    = {180, 170, 180};
+      int centerPosition[ARM_MOTORS] = { 90, 110,  85};
+
+      /**
+        @brief variables for what mode the motors are in.
+
+        @details
+        motorDisable - true: the board outputs are off and the arm will not move
+        levelMode    - true: second Y motor will move to 90deg from first Y motor
+                       false: second Y motor will be controlled by Joystick 2
+      */
+      bool motorDisable    = true;
+      bool levelMode       = false;
+      int levelMode_offset = 55;
+
+      /**
+        @brief variables for the stored program
+
+        @details
+        The program is a list of poses (one position per motor) captured with
+        addProgramStep().  During playback the motors step towards the current
+        pose by at most playbackSpeed degrees per call to play() and move on to
+        the next pose once all motors have arrived.  The program loops forever.
+      */
+      uint8_t program[ARM_PROGRAM_STEPS][ARM_MOTORS];
+      uint8_t programLength = 0;
+      uint8_t programStep   = 0;
+      uint8_t playbackSpeed = 2;
+
+      void setLevel();
+
+    public:
+
+      /**
+      @brief Class constructor. Create a new object of the robotArm
+      @param i2c (i2c address of the controller board of the arm)
+      @param disablePin (pin connected to the OE pin of the controller board)
+      */
+      robotArm(int i2c, int disablePin);
+
+      /**
+      @brief method to set the min/max/center position of one motor
+      @details
+      Call this before attach() for an arm whose servo travel is different
+      from the VE2.  The center is kept between min and max.
+      @param axis (motor to set, X1, Y1 or Y2)
+      */
+      void setMotorLimits(motorAxis_t axis, int min, int max, int center);
+
+      /**
+      @brief method to get the center position of one motor
+      */
+      int getCenterPosition(motorAxis_t axis);
+
+      /**
+      @brief method to setup the motors and disable pin of the arm
+      @details
+      Sets the min/max/center positions of the motors, attaches them to the
+      controller board and starts the arm with the motors disabled.
+      */
+      void attach();
+
+      /**
+      @brief method to move the arm from the joystick values
+      @details
+      Applies the joystick mapping to the motors.  Joystick 1 moves X1 and Y1,
+      joystick 2 moves Y2, or X1 and Y1 when level mode is on.  Nothing moves
+      while the motors are disabled.
+      */
+      void drive(int16_t x1, int16_t y1, int16_t x2, int16_t y2);
+
+      /**
+      @brief method to advance the stored program by one step
+      @details
+      Moves the motors towards the current pose of the program.  Returns false
+      when there is nothing to play (motors disabled or no program stored).
+      */
+      bool play();
+
+      /**
+      @brief methods to set, toggle or get the motor disable state
+      */
+      void setDisable(bool disable);
+      void toggleDisable();
+      bool getDisable();
+
+      /**
+      @brief methods to toggle or get the level mode state
+      @details
+      Level mode can only be changed while the motors are enabled.
+      */
+      void toggleLevelMode();
+      bool getLevelMode();
+
+      /**
+      @brief methods to manage the stored program
+      @details
+      addProgramStep() captures the current motor positions as the next pose
+      of the program and returns false when the program is full.  The version
+      with positions stores that pose instead, kept inside the motor limits.
+      */
+      bool addProgramStep();
+      bool addProgramStep(int x1, int y1, int y2);
+      void clearProgram();
+      uint8_t getProgramLength();
+      void setPlaybackSpeed(uint8_t speed);
+
+      /**
+      @brief method to get the i2c address of the arm
+      */
+      int getAddress();
+
+      /**
+      @brief method to print the current position of the motors to serial monitor
+      */
+      void printPosition();
+  };
+
+#endif